@@ -0,0 +1,75 @@
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+
+// Opt-in instrumentation of the NumLib algorithms. Enabled by compiling with
+// NUMLIB_INSTRUMENTATION defined (CMake option NUMLIB_ENABLE_INSTRUMENTATION);
+// otherwise all NUMLIB_* macros below expand to nothing.
+// Statistics are kept per thread and are never shared between threads.
+
+struct TimerStats {
+    std::uint64_t calls = 0;
+    std::uint64_t total_ns = 0;
+    std::uint64_t allocations = 0; // Heap allocations inside the scope (NUMLIB_INSTRUMENT_ALLOCATIONS only)
+};
+
+struct InstrumentationStats {
+    std::map<std::string, std::uint64_t, std::less<>> counters;
+    std::map<std::string, TimerStats, std::less<>> timers;
+};
+
+bool instrumentationEnabled();
+bool allocationTrackingEnabled();
+InstrumentationStats getInstrumentationStats();
+void resetInstrumentationStats();
+std::string instrumentationStatsToJson(const InstrumentationStats& stats);
+
+#ifdef NUMLIB_INSTRUMENTATION
+
+#include <chrono>
+
+std::uint64_t& instrumentationCounter(const char* name);
+TimerStats& instrumentationTimer(const char* name);
+std::uint64_t threadAllocationCount();
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* name)
+        : stats_(instrumentationTimer(name)),
+          start_allocations_(threadAllocationCount()),
+          start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        stats_.calls++;
+        stats_.total_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        stats_.allocations += threadAllocationCount() - start_allocations_;
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    TimerStats& stats_;
+    std::uint64_t start_allocations_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Binds a local reference to a named counter once, so hot loops only pay for an increment.
+#define NUMLIB_COUNTER(var, name) std::uint64_t& var = instrumentationCounter(name)
+#define NUMLIB_COUNT(var) (++(var))
+#define NUMLIB_COUNT_N(var, n) ((var) += static_cast<std::uint64_t>(n))
+#define NUMLIB_SCOPED_TIMER(var, name) ScopedTimer var(name)
+
+#else
+
+#define NUMLIB_COUNTER(var, name) static_cast<void>(0)
+#define NUMLIB_COUNT(var) static_cast<void>(0)
+#define NUMLIB_COUNT_N(var, n) static_cast<void>(0)
+#define NUMLIB_SCOPED_TIMER(var, name) static_cast<void>(0)
+
+#endif
+
+#endif
\ No newline at end of file
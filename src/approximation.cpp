@@ -1,9 +1,11 @@
 #include "../include/approximation.hpp"
 #include "../include/linear_algebra.hpp"
+#include "../include/instrumentation.hpp"
 #include <stdexcept>
 #include <cmath>
 
 std::vector<double> polynomialApproximation(const std::vector<double>& x, const std::vector<double>& y, int degree) {
+    NUMLIB_SCOPED_TIMER(timer, "polynomialApproximation");
     if (x.size() != y.size()) {
         throw std::invalid_argument("Input vectors x and y must have the same size.");
     }
@@ -16,19 +18,22 @@ std::vector<double> polynomialApproximation(const std::vector<double>& x, const
     std::vector<std::vector<double>> A(m, std::vector<double>(m, 0.0));
     std::vector<double> B(m, 0.0);
 
-    for (int i = 0; i < m; ++i) {
-        for (int j = 0; j < m; ++j) {
+    {
+        NUMLIB_SCOPED_TIMER(normal_equations_timer, "polynomialApproximation.normal_equations");
+        for (int i = 0; i < m; ++i) {
+            for (int j = 0; j < m; ++j) {
+                double sum = 0;
+                for (int k = 0; k < n; ++k) {
+                    sum += std::pow(x[k], i + j);
+                }
+                A[i][j] = sum;
+            }
             double sum = 0;
             for (int k = 0; k < n; ++k) {
-                sum += std::pow(x[k], i + j);
+                sum += y[k] * std::pow(x[k], i);
             }
-            A[i][j] = sum;
-        }
-        double sum = 0;
-        for (int k = 0; k < n; ++k) {
-            sum += y[k] * std::pow(x[k], i);
+            B[i] = sum;
         }
-        B[i] = sum;
     }
 
     auto coeffs = gaussianElimination(A, B);
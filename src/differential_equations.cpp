@@ -1,8 +1,12 @@
 #include "../include/differential_equations.hpp"
+#include "../include/instrumentation.hpp"
 #include <stdexcept>
 #include <cmath>
 
 ODEResult eulerMethod(std::function<double(double, double)> f, double t0, double y0, double t_end, double h) {
+    NUMLIB_COUNTER(f_evals, "eulerMethod.f_evals");
+    NUMLIB_COUNTER(steps, "eulerMethod.steps");
+    NUMLIB_SCOPED_TIMER(timer, "eulerMethod");
     if (h <= 0) {
         throw std::invalid_argument("Step h must be positive.");
     }
@@ -13,6 +17,8 @@ ODEResult eulerMethod(std::function<double(double, double)> f, double t0, double
     int num_steps = static_cast<int>((t_end - t0) / h);
     for (int i = 0; i < num_steps; ++i) {
         y += h * f(t, y);
+        NUMLIB_COUNT(steps);
+        NUMLIB_COUNT_N(f_evals, 1);
         t += h;
         results.emplace_back(t, y);
     }
@@ -20,6 +26,9 @@ ODEResult eulerMethod(std::function<double(double, double)> f, double t0, double
 }
 
 ODEResult heunMethod(std::function<double(double, double)> f, double t0, double y0, double t_end, double h) {
+    NUMLIB_COUNTER(f_evals, "heunMethod.f_evals");
+    NUMLIB_COUNTER(steps, "heunMethod.steps");
+    NUMLIB_SCOPED_TIMER(timer, "heunMethod");
     if (h <= 0) {
         throw std::invalid_argument("Step h must be positive.");
     }
@@ -32,6 +41,8 @@ ODEResult heunMethod(std::function<double(double, double)> f, double t0, double
         double k1 = f(t, y);
         double k2 = f(t + h, y + h * k1);
         y += h * 0.5 * (k1 + k2);
+        NUMLIB_COUNT(steps);
+        NUMLIB_COUNT_N(f_evals, 2);
         t += h;
         results.emplace_back(t, y);
     }
@@ -39,6 +50,9 @@ ODEResult heunMethod(std::function<double(double, double)> f, double t0, double
 }
 
 ODEResult rk4Method(std::function<double(double, double)> f, double t0, double y0, double t_end, double h) {
+    NUMLIB_COUNTER(f_evals, "rk4Method.f_evals");
+    NUMLIB_COUNTER(steps, "rk4Method.steps");
+    NUMLIB_SCOPED_TIMER(timer, "rk4Method");
     if (h <= 0) {
         throw std::invalid_argument("Step h must be positive.");
     }
@@ -53,6 +67,8 @@ ODEResult rk4Method(std::function<double(double, double)> f, double t0, double y
         double k3 = f(t + 0.5 * h, y + 0.5 * h * k2);
         double k4 = f(t + h, y + h * k3);
         y += (h / 6.0) * (k1 + 2 * k2 + 2 * k3 + k4);
+        NUMLIB_COUNT(steps);
+        NUMLIB_COUNT_N(f_evals, 4);
         t += h;
         results.emplace_back(t, y);
     }
@@ -0,0 +1,105 @@
+#include "../include/instrumentation.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace { // Per-thread storage, not exposed in header
+    thread_local InstrumentationStats thread_stats;
+    thread_local std::uint64_t thread_allocations = 0;
+
+    void appendJsonString(std::string& out, const std::string& s) {
+        out += '"';
+        for (char c : s) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        out += '"';
+    }
+
+    template<typename Map>
+    typename Map::mapped_type& lookup(Map& map, const char* name) {
+        // Registering a new name allocates; keep that out of the user's allocation counts.
+        std::uint64_t saved_allocations = thread_allocations;
+        auto it = map.find(name);
+        if (it == map.end()) it = map.emplace(name, typename Map::mapped_type{}).first;
+        thread_allocations = saved_allocations;
+        return it->second;
+    }
+}
+
+#ifdef NUMLIB_INSTRUMENT_ALLOCATIONS
+void* operator new(std::size_t size) {
+    thread_allocations++;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+#endif
+
+bool instrumentationEnabled() {
+#ifdef NUMLIB_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool allocationTrackingEnabled() {
+#ifdef NUMLIB_INSTRUMENT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t& instrumentationCounter(const char* name) {
+    return lookup(thread_stats.counters, name);
+}
+
+TimerStats& instrumentationTimer(const char* name) {
+    return lookup(thread_stats.timers, name);
+}
+
+std::uint64_t threadAllocationCount() {
+    return thread_allocations;
+}
+
+InstrumentationStats getInstrumentationStats() {
+    return thread_stats;
+}
+
+void resetInstrumentationStats() {
+    // Entries are zeroed rather than erased, since live ScopedTimers and
+    // NUMLIB_COUNTER references may still point into the maps.
+    for (auto& [name, value] : thread_stats.counters) value = 0;
+    for (auto& [name, timer] : thread_stats.timers) timer = TimerStats{};
+}
+
+std::string instrumentationStatsToJson(const InstrumentationStats& stats) {
+    std::string out = "{\"counters\":{";
+    bool first = true;
+    for (const auto& [name, value] : stats.counters) {
+        if (!first) out += ',';
+        first = false;
+        appendJsonString(out, name);
+        out += ':' + std::to_string(value);
+    }
+    out += "},\"timers\":{";
+    first = true;
+    for (const auto& [name, timer] : stats.timers) {
+        if (!first) out += ',';
+        first = false;
+        appendJsonString(out, name);
+        out += ":{\"calls\":" + std::to_string(timer.calls) +
+               ",\"total_ns\":" + std::to_string(timer.total_ns) +
+               ",\"allocations\":" + std::to_string(timer.allocations) + '}';
+    }
+    out += "}}";
+    return out;
+}
\ No newline at end of file
@@ -1,33 +1,43 @@
 #include "../include/integration.hpp"
+#include "../include/instrumentation.hpp"
 #include <cmath>
 #include <vector>
 #include <stdexcept>
 
 double rectangleMethod(std::function<double(double)> f, double a, double b, int n) {
+    NUMLIB_COUNTER(f_evals, "rectangleMethod.f_evals");
+    NUMLIB_SCOPED_TIMER(timer, "rectangleMethod");
     double h = (b - a) / n;
     double integral = 0.0;
     for (int i = 0; i < n; i++) {
         integral += f(a + i * h);
     }
+    NUMLIB_COUNT_N(f_evals, n > 0 ? n : 0);
     return integral * h;
 }
 
 double trapezoidalMethod(std::function<double(double)> f, double a, double b, int n) {
+    NUMLIB_COUNTER(f_evals, "trapezoidalMethod.f_evals");
+    NUMLIB_SCOPED_TIMER(timer, "trapezoidalMethod");
     double h = (b - a) / n;
     double integral = 0.5 * (f(a) + f(b));
     for (int i = 1; i < n; i++) {
         integral += f(a + i * h);
     }
+    NUMLIB_COUNT_N(f_evals, n > 1 ? n + 1 : 2);
     return integral * h;
 }
 
 double simpsonMethod(std::function<double(double)> f, double a, double b, int n) {
+    NUMLIB_COUNTER(f_evals, "simpsonMethod.f_evals");
+    NUMLIB_SCOPED_TIMER(timer, "simpsonMethod");
     if (n % 2 != 0) n++; // Simpson's rule requires an even number of intervals
     double h = (b - a) / n;
     double integral = f(a) + f(b);
     for (int i = 1; i < n; i++) {
         integral += (i % 2 == 0 ? 2 : 4) * f(a + i * h);
     }
+    NUMLIB_COUNT_N(f_evals, n > 1 ? n + 1 : 2);
     return integral * h / 3.0;
 }
 
@@ -58,6 +68,8 @@ namespace { // Helper function, not exposed in header
 }
 
 double compositeGaussLegendre(std::function<double(double)> f, double a, double b, int n_points, int subdivisions) {
+    NUMLIB_COUNTER(f_evals, "compositeGaussLegendre.f_evals");
+    NUMLIB_SCOPED_TIMER(timer, "compositeGaussLegendre");
     GaussLegendreData gl_data = getGLData(n_points);
     double total_integral = 0.0;
     double h = (b - a) / subdivisions;
@@ -73,6 +85,7 @@ double compositeGaussLegendre(std::function<double(double)> f, double a, double
             sub_integral += w * f(x);
         }
         total_integral += (sub_b - sub_a) / 2.0 * sub_integral;
+        NUMLIB_COUNT_N(f_evals, n_points);
     }
     return total_integral;
 }
\ No newline at end of file
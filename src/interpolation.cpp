@@ -1,7 +1,9 @@
 #include "../include/interpolation.hpp"
+#include "../include/instrumentation.hpp"
 #include <stdexcept>
 
 double lagrangeInterpolation(const std::vector<double>& x, const std::vector<double>& y, double xp) {
+    NUMLIB_SCOPED_TIMER(timer, "lagrangeInterpolation");
     if (x.size() != y.size() || x.empty()) {
         throw std::invalid_argument("Node vectors must have the same, non-zero size.");
     }
@@ -23,6 +25,7 @@ double lagrangeInterpolation(const std::vector<double>& x, const std::vector<dou
 }
 
 std::vector<double> calculateDividedDifferences(const std::vector<double>& x, const std::vector<double>& y) {
+    NUMLIB_SCOPED_TIMER(timer, "calculateDividedDifferences");
     if (x.size() != y.size() || x.empty()) {
         throw std::invalid_argument("Node vectors must have the same, non-zero size.");
     }
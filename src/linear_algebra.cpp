@@ -1,31 +1,39 @@
 #include "../include/linear_algebra.hpp"
+#include "../include/instrumentation.hpp"
 #include <cmath>
 #include <stdexcept>
 
 std::optional<std::vector<double>> gaussianElimination(std::vector<std::vector<double>> a, std::vector<double> b) {
+    NUMLIB_COUNTER(row_swaps, "gaussianElimination.row_swaps");
+    NUMLIB_SCOPED_TIMER(timer, "gaussianElimination");
     const double epsilon = 1e-12;
     size_t n = b.size();
     if (a.size() != n || (n > 0 && a[0].size() != n)) {
         throw std::invalid_argument("Matrix and vector dimensions do not match.");
     }
-    for (size_t i = 0; i < n; ++i) {
-        size_t maxRow = i;
-        for (size_t k = i + 1; k < n; ++k) {
-            if (std::abs(a[k][i]) > std::abs(a[maxRow][i])) {
-                maxRow = k;
+    {
+        NUMLIB_SCOPED_TIMER(elimination_timer, "gaussianElimination.elimination");
+        for (size_t i = 0; i < n; ++i) {
+            size_t maxRow = i;
+            for (size_t k = i + 1; k < n; ++k) {
+                if (std::abs(a[k][i]) > std::abs(a[maxRow][i])) {
+                    maxRow = k;
+                }
             }
-        }
-        std::swap(a[i], a[maxRow]);
-        std::swap(b[i], b[maxRow]);
-        if (std::abs(a[i][i]) < epsilon) return std::nullopt;
-        for (size_t k = i + 1; k < n; ++k) {
-            double factor = a[k][i] / a[i][i];
-            for (size_t j = i; j < n; ++j) {
-                a[k][j] -= factor * a[i][j];
+            if (maxRow != i) NUMLIB_COUNT(row_swaps);
+            std::swap(a[i], a[maxRow]);
+            std::swap(b[i], b[maxRow]);
+            if (std::abs(a[i][i]) < epsilon) return std::nullopt;
+            for (size_t k = i + 1; k < n; ++k) {
+                double factor = a[k][i] / a[i][i];
+                for (size_t j = i; j < n; ++j) {
+                    a[k][j] -= factor * a[i][j];
+                }
+                b[k] -= factor * b[i];
             }
-            b[k] -= factor * b[i];
         }
     }
+    NUMLIB_SCOPED_TIMER(substitution_timer, "gaussianElimination.back_substitution");
     std::vector<double> x(n);
     for (int i = n - 1; i >= 0; --i) {
         x[i] = b[i];
@@ -38,6 +46,7 @@ std::optional<std::vector<double>> gaussianElimination(std::vector<std::vector<d
 }
 
 std::pair<std::vector<std::vector<double>>, std::vector<std::vector<double>>> luDecomposition(const std::vector<std::vector<double>>& a) {
+    NUMLIB_SCOPED_TIMER(timer, "luDecomposition");
     size_t n = a.size();
     std::vector<std::vector<double>> L(n, std::vector<double>(n, 0.0));
     std::vector<std::vector<double>> U(n, std::vector<double>(n, 0.0));
@@ -62,6 +71,7 @@ std::pair<std::vector<std::vector<double>>, std::vector<std::vector<double>>> lu
 }
 
 std::vector<double> forwardSubstitution(const std::vector<std::vector<double>>& L, const std::vector<double>& b) {
+    NUMLIB_SCOPED_TIMER(timer, "forwardSubstitution");
     int n = b.size();
     std::vector<double> y(n);
     for (int i = 0; i < n; i++) {
@@ -74,6 +84,7 @@ std::vector<double> forwardSubstitution(const std::vector<std::vector<double>>&
 }
 
 std::vector<double> backwardSubstitution(const std::vector<std::vector<double>>& U, const std::vector<double>& y) {
+    NUMLIB_SCOPED_TIMER(timer, "backwardSubstitution");
     int n = y.size();
     std::vector<double> x(n);
     for (int i = n - 1; i >= 0; i--) {
@@ -1,12 +1,20 @@
 #include "../include/nonlinear_equations.hpp"
+#include "../include/instrumentation.hpp"
 #include <cmath>
 
 std::optional<double> bisection(std::function<double(double)> f, double a, double b, double tol, int max_iter) {
+    NUMLIB_COUNTER(f_evals, "bisection.f_evals");
+    NUMLIB_COUNTER(iterations, "bisection.iterations");
+    NUMLIB_SCOPED_TIMER(timer, "bisection");
+    NUMLIB_COUNT_N(f_evals, 2);
     if (f(a) * f(b) >= 0.0) return std::nullopt;
     double c = a;
     for (int i = 0; i < max_iter; ++i) {
+        NUMLIB_COUNT(iterations);
         c = (a + b) / 2.0;
+        NUMLIB_COUNT(f_evals);
         if (std::abs(f(c)) < tol || (b - a) / 2.0 < tol) return c;
+        NUMLIB_COUNT_N(f_evals, 2);
         if (f(c) * f(a) < 0.0) b = c;
         else a = c;
     }
@@ -14,7 +22,14 @@ std::optional<double> bisection(std::function<double(double)> f, double a, doubl
 }
 
 std::optional<double> newtonMethod(std::function<double(double)> f, std::function<double(double)> df, double x0, double tol, int max_iter) {
+    NUMLIB_COUNTER(f_evals, "newtonMethod.f_evals");
+    NUMLIB_COUNTER(df_evals, "newtonMethod.df_evals");
+    NUMLIB_COUNTER(iterations, "newtonMethod.iterations");
+    NUMLIB_SCOPED_TIMER(timer, "newtonMethod");
     for (int i = 0; i < max_iter; ++i) {
+        NUMLIB_COUNT(iterations);
+        NUMLIB_COUNT(f_evals);
+        NUMLIB_COUNT(df_evals);
         double fx = f(x0);
         double dfx = df(x0);
         if (std::abs(dfx) < 1e-12) return std::nullopt; // Pochodna bliska zeru
@@ -26,7 +41,12 @@ std::optional<double> newtonMethod(std::function<double(double)> f, std::functio
 }
 
 std::optional<double> secantMethod(std::function<double(double)> f, double x0, double x1, double tol, int max_iter) {
+    NUMLIB_COUNTER(f_evals, "secantMethod.f_evals");
+    NUMLIB_COUNTER(iterations, "secantMethod.iterations");
+    NUMLIB_SCOPED_TIMER(timer, "secantMethod");
     for (int i = 0; i < max_iter; ++i) {
+        NUMLIB_COUNT(iterations);
+        NUMLIB_COUNT_N(f_evals, 2);
         double fx0 = f(x0);
         double fx1 = f(x1);
         if (std::abs(fx1 - fx0) < 1e-12) return std::nullopt;
@@ -39,13 +59,20 @@ std::optional<double> secantMethod(std::function<double(double)> f, double x0, d
 }
 
 std::optional<double> regulaFalsi(std::function<double(double)> f, double a, double b, double tol, int max_iter) {
+    NUMLIB_COUNTER(f_evals, "regulaFalsi.f_evals");
+    NUMLIB_COUNTER(iterations, "regulaFalsi.iterations");
+    NUMLIB_SCOPED_TIMER(timer, "regulaFalsi");
+    NUMLIB_COUNT_N(f_evals, 2);
     if (f(a) * f(b) >= 0) return std::nullopt;
     double x = a;
     for (int i = 0; i < max_iter; ++i) {
+        NUMLIB_COUNT(iterations);
+        NUMLIB_COUNT_N(f_evals, 2);
         double fa = f(a);
         double fb = f(b);
         if (std::abs(fb - fa) < 1e-12) return std::nullopt;
         x = b - fb * (b - a) / (fb - fa);
+        NUMLIB_COUNT(f_evals);
         double fx = f(x);
         if (std::abs(fx) < tol) return x;
         if (fa * fx < 0.0) b = x;
@@ -11,6 +11,7 @@
 #include "../include/integration.hpp"
 #include "../include/differential_equations.hpp"
 #include "../include/nonlinear_equations.hpp"
+#include "../include/instrumentation.hpp"
 
 // --- Funkcje pomocnicze do asercji ---
 const double TOL = 1e-9;
@@ -102,6 +103,29 @@ void run_nonlinear_equations_tests() {
     std::cout << "OK\n";
 }
 
+void run_instrumentation_tests() {
+    std::cout << "Testy: Instrumentacja... ";
+    resetInstrumentationStats();
+    rk4Method([](double t, double y) { return y; }, 0, 1, 1.0, 0.1);
+    compositeGaussLegendre([](double x) { return x; }, 0.0, 1.0, 3, 5);
+    auto stats = getInstrumentationStats();
+    if (instrumentationEnabled()) {
+        // 1. liczniki wywolan f: 4 na krok RK4, n_points na podprzedzial
+        assert(stats.counters.at("rk4Method.f_evals") == 40);
+        assert(stats.counters.at("compositeGaussLegendre.f_evals") == 15);
+        assert(stats.timers.at("rk4Method").calls == 1);
+        // 2. reset zeruje statystyki
+        resetInstrumentationStats();
+        assert(getInstrumentationStats().counters.at("rk4Method.f_evals") == 0);
+    } else {
+        // 1. bez NUMLIB_INSTRUMENTATION nic nie jest zbierane
+        assert(stats.counters.empty() && stats.timers.empty());
+        // 2. zrzut JSON pustych statystyk
+        assert(instrumentationStatsToJson(stats) == "{\"counters\":{},\"timers\":{}}");
+    }
+    std::cout << "OK\n";
+}
+
 
 int main() {
     try {
@@ -111,6 +135,7 @@ int main() {
         run_integration_tests();
         run_differential_equations_tests();
         run_nonlinear_equations_tests();
+        run_instrumentation_tests();
         std::cout << "\n--- WSZYSTKIE TESTY ZAKONCZONE POMYSLNIE ---\n";
     } catch (const std::exception& e) {
         std::cerr << "\n\n--- WYSTAPIL KRYTYCZNY BLAD PODCZAS TESTOW: " << e.what() << " ---\n";